@@ -17,6 +17,14 @@ void clearScreen()
     printf("\033[2J");
 }
 
+/**
+ * This function returns the difference a - b between two timespecs in nanoseconds.
+ */
+long timespec_diff_ns(struct timespec a, struct timespec b)
+{
+    return (a.tv_sec - b.tv_sec) * NS_PER_SEC + (a.tv_nsec - b.tv_nsec);
+}
+
 /**
  * This function retrieves system resource usage information, such as memory usage,
  * and prints it to the standard output. It utilizes the `getrusage` function to
@@ -70,69 +78,79 @@ void get_memory_utilization(char buf[MAX_LENGTH], double *physical_used)
 }
 
 /**
- * This function reads memory utilization information from a pipe and optionally from a graphics pipe,
- * then formats and prints the information to the standard output.
- * If graphics is enabled, it also visualizes the change in memory utilization compared
+ * This function formats the wall clock time of a snapshot as HH:MM:SS.mmm into the provided buffer.
+ *
+ * @param snapshot The snapshot whose realtime stamp is formatted.
+ * @param buf The buffer to store the formatted time (should have a capacity of at least TIME_LENGTH).
+ */
+void format_snapshot_time(const system_snapshot *snapshot, char buf[TIME_LENGTH])
+{
+    struct tm local;
+    char hms[TIME_LENGTH / 2];
+    localtime_r(&snapshot->realtime.tv_sec, &local);
+    strftime(hms, sizeof(hms), "%H:%M:%S", &local);
+    snprintf(buf, TIME_LENGTH, "%s.%03ld", hms, snapshot->realtime.tv_nsec / 1000000 % 1000);
+}
+
+/**
+ * This function appends count copies of mark to buf, stopping once buf (of size MAX_LENGTH) is full.
+ *
+ * @param buf The null-terminated buffer to append to.
+ * @param mark The character to append.
+ * @param count The number of characters to append.
+ */
+void append_bar(char buf[MAX_LENGTH], char mark, int count)
+{
+    size_t len = strlen(buf);
+    for (int i = 0; i < count && len + 1 < MAX_LENGTH; i++)
+    {
+        buf[len++] = mark;
+    }
+    buf[len] = '\0';
+}
+
+/**
+ * This function prints the memory utilization of a snapshot to the standard output, prefixed with the
+ * snapshot time. If graphics is enabled, it also visualizes the change in memory utilization compared
  * to the previous value using ASCII characters.
  *
- * @param pipes An array containing file descriptors for the memory pipe (pipes[0] for reading).
- * @param graphics_pipe An array containing file descriptors for the graphics pipe (graphics_pipe[0] for reading).
+ * @param snapshot The snapshot holding the memory utilization information.
  * @param graphics Flag indicating whether to enable graphics visualization (1 for enabled, 0 for disabled).
  * @param physical_used Pointer to the amount of physical memory used (updated by reference).
  */
-void print_memory_utilization(int pipes[2], int graphics_pipe[2], int graphics, double *physical_used)
+void print_memory_utilization(const system_snapshot *snapshot, int graphics, double *physical_used)
 {
     char buf[MAX_LENGTH];
-    double new_used;
-    close(pipes[1]);
-    close(graphics_pipe[1]);
-    ssize_t total_bytes_read = 0;
-    while (total_bytes_read < sizeof(buf))
-    {
-        ssize_t bytes_read = read(pipes[0], buf + total_bytes_read, sizeof(buf) - total_bytes_read);
-        if (bytes_read == -1)
-        {
-            perror("Error reading from memory pipe");
-            exit(EXIT_FAILURE);
-        }
-        total_bytes_read += bytes_read;
-    }
-    buf[total_bytes_read] = '\0';
-    close(pipes[0]);
+    char stamp[TIME_LENGTH];
+    format_snapshot_time(snapshot, stamp);
+    snprintf(buf, sizeof(buf), "[%s] ", stamp);
+    snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf), "%s", snapshot->memory);
     if (graphics == 1)
     {
-        read(graphics_pipe[0], &new_used, sizeof(new_used));
+        double new_used = snapshot->physical_used;
         double util_diff = new_used - *physical_used;
         int diff_count = util_diff / 0.01;
         if (*physical_used == 0)
             util_diff = 0;
 
-        strcat(buf, "\t|");
+        append_bar(buf, '\t', 1);
+        append_bar(buf, '|', 1);
         if (util_diff == 0)
         {
-            strcat(buf, "o");
+            append_bar(buf, 'o', 1);
         }
         else if (util_diff > 0)
         {
-            for (int i = 0; i < diff_count; i++)
-            {
-                strcat(buf, "#");
-            }
-            strcat(buf, "*");
+            append_bar(buf, '#', diff_count);
+            append_bar(buf, '*', 1);
         }
         else
         {
-            for (int i = 0; i < -diff_count; i++)
-            {
-                strcat(buf, ":");
-            }
-            strcat(buf, "@");
+            append_bar(buf, ':', -diff_count);
+            append_bar(buf, '@', 1);
         }
-        char line[MAX_LENGTH];
-        sprintf(line, " %.2f (%.2f)", util_diff, new_used);
-        strcat(buf, line);
+        snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf), " %.2f (%.2f)", util_diff, new_used);
     }
-    close(graphics_pipe[0]);
 
     printf("%s\n", buf);
 }
@@ -159,30 +177,20 @@ void get_connected_user(char users[MAX_USERS][MAX_LENGTH], int *index)
 }
 
 /**
- * This function reads information about connected users from a pipe and prints it to the standard output.
- * It expects the information to be formatted as an array of strings containing details about each connected user.
+ * This function prints the connected users of a snapshot to the standard output, followed by a
+ * separator carrying the snapshot time and the measured collection skew.
  *
- * @param pipes An array containing file descriptors for the pipe (pipes[0] for reading).
- * @param rows The number of rows to read from the pipe and print to the output.
+ * @param snapshot The snapshot holding the connected users.
  */
-void print_connected_user(int pipes[2], int rows)
+void print_connected_user(const system_snapshot *snapshot)
 {
-
-    close(pipes[1]);
-    char new_users[MAX_USERS][MAX_LENGTH];
-    ssize_t bytes_read = read(pipes[0], &new_users, rows * MAX_LENGTH);
-    if (bytes_read == -1)
-    {
-        printf("Error reading users pipe");
-        exit(EXIT_FAILURE);
-    }
-
-    for (int i = 0; i < rows; i++)
+    char stamp[TIME_LENGTH];
+    format_snapshot_time(snapshot, stamp);
+    for (int i = 0; i < snapshot->rows; i++)
     {
-        printf("%s\n", new_users[i]);
+        printf("%s\n", snapshot->users[i]);
     }
-    printf("---------------------------------------\n");
-    close(pipes[0]);
+    printf("--- snapshot %s (skew %ld us) ---\n", stamp, snapshot->skew_ns / 1000);
 }
 
 /**
@@ -243,34 +251,38 @@ void get_cpu_utilization(long cpu_data[2])
 }
 
 /**
- * This function reads CPU utilization data from a pipe and calculates CPU utilization percentage.
+ * This function calculates the CPU utilization percentage of a snapshot against the first sample and
+ * prints it together with the snapshot time and the monotonic time elapsed since that first sample.
  * It optionally visualizes the CPU utilization using ASCII characters if graphics is enabled.
  *
- * @param pipes An array containing file descriptors for the pipe (pipes[0] for reading).
- * @param data Array containing previous CPU utilization data (total CPU time and idle time).
+ * @param snapshot The snapshot holding the CPU utilization data.
+ * @param data Array containing the first CPU utilization data (total CPU time and idle time).
+ * @param since Monotonic time of the first sample.
  * @param id Identifier for the CPU.
  * @param graphics Flag indicating whether to enable graphics visualization (1 for enabled, 0 for disabled).
  * @param cursor Cursor position for printing graphics visualization.
  */
-void print_cpu_utilization(int pipes[2], long data[2], int id, int graphics, int cursor)
+void print_cpu_utilization(const system_snapshot *snapshot, long data[2], struct timespec *since, int id, int graphics, int cursor)
 {
-    long cpu_data[2];
+    char stamp[TIME_LENGTH];
     double cpu_utilization = 0;
     long idle_diff = 0, time_diff = 0;
-    read(pipes[0], &cpu_data, 2 * sizeof(long));
     if (id == 0)
     {
-        data[0] = cpu_data[0];
-        data[1] = cpu_data[1];
+        data[0] = snapshot->cpu_data[0];
+        data[1] = snapshot->cpu_data[1];
+        *since = snapshot->monotonic;
     }
     if (id > 0)
     {
-        idle_diff = cpu_data[1] - data[1];
-        time_diff = cpu_data[0] - data[0];
-        cpu_utilization = (double)(time_diff - idle_diff) / time_diff * 100;
+        idle_diff = snapshot->cpu_data[1] - data[1];
+        time_diff = snapshot->cpu_data[0] - data[0];
+        if (time_diff > 0)
+            cpu_utilization = (double)(time_diff - idle_diff) / time_diff * 100;
     }
-    close(pipes[0]);
-    printf("total cpu use = %.2f%%\n", cpu_utilization);
+    format_snapshot_time(snapshot, stamp);
+    double elapsed = (double)timespec_diff_ns(snapshot->monotonic, *since) / NS_PER_SEC;
+    printf("total cpu use = %.2f%% [%s, +%.3fs]\n", cpu_utilization, stamp, elapsed);
     if (graphics == 1 && id > 0 && cpu_utilization > 0)
     {
         moveCursorTo(cursor + id + 1, 1);
@@ -280,7 +292,7 @@ void print_cpu_utilization(int pipes[2], long data[2], int id, int graphics, int
         {
             printf("|");
         }
-        printf("  %.2f\n", cpu_utilization);
+        printf("  %.2f [%s]\n", cpu_utilization, stamp);
     }
 }
 
@@ -332,6 +344,259 @@ void get_system_info()
     printf("---------------------------------------\n");
 }
 
+/**
+ * This function reads exactly len bytes from a pipe, exiting with the given message on failure.
+ */
+void read_fully(int fd, void *buf, size_t len, const char *error)
+{
+    size_t total_bytes_read = 0;
+    while (total_bytes_read < len)
+    {
+        ssize_t bytes_read = read(fd, (char *)buf + total_bytes_read, len - total_bytes_read);
+        if (bytes_read == -1)
+        {
+            perror(error);
+            exit(EXIT_FAILURE);
+        }
+        if (bytes_read == 0)
+        {
+            fprintf(stderr, "%s: unexpected end of pipe\n", error);
+            exit(EXIT_FAILURE);
+        }
+        total_bytes_read += bytes_read;
+    }
+}
+
+/**
+ * This function writes exactly len bytes to a pipe, exiting with the given message on failure.
+ */
+void write_fully(int fd, const void *buf, size_t len, const char *error)
+{
+    size_t total_bytes_write = 0;
+    while (total_bytes_write < len)
+    {
+        ssize_t bytes_write = write(fd, (const char *)buf + total_bytes_write, len - total_bytes_write);
+        if (bytes_write == -1)
+        {
+            perror(error);
+            exit(EXIT_FAILURE);
+        }
+        total_bytes_write += bytes_write;
+    }
+}
+
+/**
+ * This function blocks a collector until the parent releases the start barrier by closing its write
+ * end of the start pipe.
+ *
+ * @param start_fd An array containing file descriptors for the start pipe.
+ */
+void wait_for_start(int start_fd[2])
+{
+    char release;
+    close(start_fd[1]);
+    if (read(start_fd[0], &release, sizeof(release)) == -1)
+    {
+        perror("Error waiting on start barrier");
+        exit(EXIT_FAILURE);
+    }
+    close(start_fd[0]);
+}
+
+/**
+ * This collector samples memory utilization once released and writes the monotonic start and end
+ * of its read, the formatted memory information and the physical memory used to the result pipe.
+ */
+void collect_memory(int start_fd[2], int result_fd)
+{
+    char buf[MAX_LENGTH];
+    double physical_used;
+    struct timespec window[2];
+    wait_for_start(start_fd);
+    clock_gettime(CLOCK_MONOTONIC, &window[0]);
+    get_memory_utilization(buf, &physical_used);
+    clock_gettime(CLOCK_MONOTONIC, &window[1]);
+    write_fully(result_fd, window, sizeof(window), "Error writing to memory pipe");
+    write_fully(result_fd, buf, sizeof(buf), "Error writing to memory pipe");
+    write_fully(result_fd, &physical_used, sizeof(physical_used), "Error writing to memory pipe");
+}
+
+/**
+ * This collector samples the connected users once released and writes the monotonic start and end
+ * of its read, the number of users and the users themselves to the result pipe.
+ */
+void collect_users(int start_fd[2], int result_fd)
+{
+    char all_users[MAX_USERS][MAX_LENGTH];
+    int rows = 0;
+    struct timespec window[2];
+    wait_for_start(start_fd);
+    clock_gettime(CLOCK_MONOTONIC, &window[0]);
+    get_connected_user(all_users, &rows);
+    clock_gettime(CLOCK_MONOTONIC, &window[1]);
+    write_fully(result_fd, window, sizeof(window), "Error writing to users pipe");
+    write_fully(result_fd, &rows, sizeof(rows), "Error writing to users pipe");
+    write_fully(result_fd, all_users, rows * MAX_LENGTH, "Error writing to users pipe");
+}
+
+/**
+ * This collector samples CPU utilization once released and writes the monotonic start and end of
+ * its read and the CPU data to the result pipe.
+ */
+void collect_cpu(int start_fd[2], int result_fd)
+{
+    long cpu_data[2];
+    struct timespec window[2];
+    wait_for_start(start_fd);
+    clock_gettime(CLOCK_MONOTONIC, &window[0]);
+    get_cpu_utilization(cpu_data);
+    clock_gettime(CLOCK_MONOTONIC, &window[1]);
+    write_fully(result_fd, window, sizeof(window), "Error writing to cpu pipe");
+    write_fully(result_fd, cpu_data, sizeof(cpu_data), "Error writing to cpu pipe");
+}
+
+/**
+ * This function creates the result pipe of a collector and forks a child process running it.
+ *
+ * @param start_fd An array containing file descriptors for the shared start pipe.
+ * @param result_fd An array receiving the file descriptors for the collector result pipe.
+ * @param inherited Read ends of the result pipes of collectors spawned earlier, closed in the child.
+ * @param inherited_count The number of file descriptors in inherited.
+ * @param collect The collector to run in the child process.
+ *
+ * @return The pid of the collector child process.
+ */
+pid_t spawn_collector(int start_fd[2], int result_fd[2], int inherited[], int inherited_count, void (*collect)(int start_fd[2], int result_fd))
+{
+    if (pipe(result_fd) == -1)
+    {
+        perror("failed to create pipe");
+        exit(EXIT_FAILURE);
+    }
+    pid_t pid = fork();
+    if (pid == -1)
+    {
+        perror("fork failed");
+        exit(EXIT_FAILURE);
+    }
+    else if (pid == 0)
+    {
+        for (int i = 0; i < inherited_count; i++)
+        {
+            close(inherited[i]);
+        }
+        close(result_fd[0]);
+        collect(start_fd, result_fd[1]);
+        close(result_fd[1]);
+        exit(EXIT_SUCCESS);
+    }
+    close(result_fd[1]);
+    return pid;
+}
+
+/**
+ * This function widens the [earliest, latest] window of collector reads with the start and end of a read.
+ */
+void track_skew(struct timespec window[2], struct timespec *earliest, struct timespec *latest)
+{
+    if (timespec_diff_ns(window[0], *earliest) < 0)
+        *earliest = window[0];
+    if (timespec_diff_ns(window[1], *latest) > 0)
+        *latest = window[1];
+}
+
+/**
+ * This function returns the timespec t shifted by ns nanoseconds.
+ */
+struct timespec timespec_add_ns(struct timespec t, long ns)
+{
+    ns += t.tv_nsec;
+    t.tv_sec += ns / NS_PER_SEC;
+    t.tv_nsec = ns % NS_PER_SEC;
+    if (t.tv_nsec < 0)
+    {
+        t.tv_sec--;
+        t.tv_nsec += NS_PER_SEC;
+    }
+    return t;
+}
+
+/**
+ * This function forks all required collectors, releases them together through a start barrier and
+ * gathers their results into a single snapshot stamped with CLOCK_MONOTONIC and CLOCK_REALTIME at the
+ * start of the earliest collector read, along with the skew from that start to the end of the latest
+ * collector read. The realtime stamp is derived from a pair of clock readings taken at release.
+ *
+ * @param snapshot The snapshot to fill.
+ * @param system Flag indicating whether memory utilization should be collected.
+ * @param user Flag indicating whether connected users should be collected.
+ */
+void collect_snapshot(system_snapshot *snapshot, int system, int user)
+{
+    int start_fd[2], memory_fd[2], users_fd[2], cpu_fd[2];
+    int inherited[2];
+    int inherited_count = 0;
+    pid_t memory = 0, users = 0;
+    struct timespec window[2], earliest, latest, released;
+
+    if (pipe(start_fd) == -1)
+    {
+        perror("failed to create pipe");
+        exit(EXIT_FAILURE);
+    }
+    fflush(stdout);
+    if (system == 1)
+    {
+        memory = spawn_collector(start_fd, memory_fd, inherited, inherited_count, collect_memory);
+        inherited[inherited_count++] = memory_fd[0];
+    }
+    if (user == 1)
+    {
+        users = spawn_collector(start_fd, users_fd, inherited, inherited_count, collect_users);
+        inherited[inherited_count++] = users_fd[0];
+    }
+    pid_t cpu = spawn_collector(start_fd, cpu_fd, inherited, inherited_count, collect_cpu);
+
+    close(start_fd[0]);
+    clock_gettime(CLOCK_MONOTONIC, &released);
+    clock_gettime(CLOCK_REALTIME, &snapshot->realtime);
+    close(start_fd[1]);
+
+    read_fully(cpu_fd[0], window, sizeof(window), "Error reading from cpu pipe");
+    read_fully(cpu_fd[0], snapshot->cpu_data, sizeof(snapshot->cpu_data), "Error reading from cpu pipe");
+    close(cpu_fd[0]);
+    earliest = window[0];
+    latest = window[1];
+
+    if (system == 1)
+    {
+        read_fully(memory_fd[0], window, sizeof(window), "Error reading from memory pipe");
+        read_fully(memory_fd[0], snapshot->memory, sizeof(snapshot->memory), "Error reading from memory pipe");
+        read_fully(memory_fd[0], &snapshot->physical_used, sizeof(snapshot->physical_used), "Error reading from memory pipe");
+        close(memory_fd[0]);
+        track_skew(window, &earliest, &latest);
+    }
+
+    snapshot->rows = 0;
+    if (user == 1)
+    {
+        read_fully(users_fd[0], window, sizeof(window), "Error reading users pipe");
+        read_fully(users_fd[0], &snapshot->rows, sizeof(snapshot->rows), "Error reading users pipe");
+        read_fully(users_fd[0], snapshot->users, snapshot->rows * MAX_LENGTH, "Error reading users pipe");
+        close(users_fd[0]);
+        track_skew(window, &earliest, &latest);
+    }
+    snapshot->skew_ns = timespec_diff_ns(latest, earliest);
+    snapshot->monotonic = earliest;
+    snapshot->realtime = timespec_add_ns(snapshot->realtime, timespec_diff_ns(earliest, released));
+
+    waitpid(cpu, NULL, 0);
+    if (system == 1)
+        waitpid(memory, NULL, 0);
+    if (user == 1)
+        waitpid(users, NULL, 0);
+}
+
 void print_header(int base, int samples, int tdelay, int system, int user)
 {
     get_system_usage(samples, tdelay);
@@ -355,13 +620,12 @@ void print_header(int base, int samples, int tdelay, int system, int user)
  */
 void print_system_status(int flags[FLAGS_LENGTH], int samples, int tdelay)
 {
-    ssize_t bytes_write = 0;
     int saved_rows = 0;
     int base = 0;
-    char buf[MAX_LENGTH];
     long cpu_data[2];
+    struct timespec since;
     double physical_used = 0;
-    int memory_pipes[samples][2], users_pipes[samples][2], cpu_pipes[samples][2];
+    system_snapshot snapshot;
     int system = flags[0];
     int user = flags[1];
     int graphics = flags[2];
@@ -370,7 +634,6 @@ void print_system_status(int flags[FLAGS_LENGTH], int samples, int tdelay)
     print_header(base, samples, tdelay, system, user);
     for (int i = 0; i < samples; i++)
     {
-        int system_graphic_fd[2];
         if (sequential == 1 && i % 2 == 0)
         {
             clearScreen();
@@ -379,169 +642,57 @@ void print_system_status(int flags[FLAGS_LENGTH], int samples, int tdelay)
         else if (sequential == 1)
             base = samples + saved_rows + 13;
 
-        if (pipe(memory_pipes[i]) == -1 || pipe(system_graphic_fd) == -1)
-        {
-            perror("failed to create pipe");
+        collect_snapshot(&snapshot, system, user);
+        saved_rows = snapshot.rows;
 
-            exit(EXIT_FAILURE);
+        if (sequential == 1)
+            print_header(base, samples, tdelay, system, user);
+        moveCursorTo(base + i + 5, 1);
+        if (system == 1)
+            print_memory_utilization(&snapshot, graphics, &physical_used);
+        if (user == 1)
+        {
+            if (system == 1)
+                moveCursorTo(base + samples + 7, 1);
+            else
+                moveCursorTo(base + 5, 1);
+            print_connected_user(&snapshot);
         }
-        pid_t memory = fork();
 
-        if (memory == -1)
+        if (system == 1 && user == 1)
         {
-            perror("fork failed");
-            exit(EXIT_FAILURE);
+            moveCursorTo(base + samples + saved_rows + 8, 1);
         }
-        else if (memory == 0)
+        else if (system == 1)
         {
-            if (system != 1)
-            {
-                close(memory_pipes[i][1]);
-                close(memory_pipes[i][0]);
-                exit(EXIT_SUCCESS);
-            }
-
-            get_memory_utilization(buf, &physical_used);
-            bytes_write = write(memory_pipes[i][1], buf, sizeof(buf));
-            if (bytes_write == -1)
-            {
-                perror("Error writing to memory pipe");
-                exit(EXIT_FAILURE);
-            }
-            if (graphics == 1)
-            {
-                bytes_write = write(system_graphic_fd[1], &physical_used, sizeof(physical_used));
-                if (bytes_write == -1)
-                {
-                    perror("Error writing to memory pipe");
-                    exit(EXIT_FAILURE);
-                }
-            }
-            close(system_graphic_fd[1]);
-            exit(EXIT_SUCCESS);
+            moveCursorTo(base + samples + 6, 1);
+        }
+        else if (user == 1)
+        {
+            moveCursorTo(base + saved_rows + 6, 1);
         }
+        printf("Number of cores: %d", cores);
 
-        else
+        int cursor = 0;
+        if (system == 1 && user == 1)
         {
-            double new_physical_used = 0;
-            if (sequential == 1)
-                print_header(base, samples, tdelay, system, user);
-            moveCursorTo(base + i + 5, 1);
-            if (system == 1)
-                print_memory_utilization(memory_pipes[i], system_graphic_fd, graphics, &new_physical_used);
-            int rows_fd[2];
-            int rows = 0;
-            if (pipe(users_pipes[i]) == -1 || pipe(rows_fd) == -1)
-            {
-                perror("failed to create pipe");
-                exit(EXIT_FAILURE);
-            }
-            pid_t users = fork();
-            if (users == -1)
-            {
-                perror("fork failed");
-                exit(EXIT_FAILURE);
-            }
-            else if (users == 0)
-            {
-                if (user != 1)
-                {
-                    close(users_pipes[i][1]);
-                    close(users_pipes[i][0]);
-                    close(rows_fd[1]);
-                    close(rows_fd[0]);
-                    exit(EXIT_SUCCESS);
-                }
-                char all_users[MAX_USERS][MAX_LENGTH];
-                get_connected_user(all_users, &rows);
-                bytes_write = write(users_pipes[i][1], &all_users, rows * MAX_LENGTH);
-                if (bytes_write == -1)
-                {
-                    perror("Error writing to users pipe");
-                    exit(EXIT_FAILURE);
-                }
-                if (system == 1)
-                    moveCursorTo(base + samples + 7, 1);
-                else
-                    moveCursorTo(base + 5, 1);
-                print_connected_user(users_pipes[i], rows);
-                write(rows_fd[1], &rows, sizeof(rows));
-                close(rows_fd[1]);
-                exit(EXIT_SUCCESS);
-            }
-            else
-            {
-                if (user == 1)
-                {
-                    read(rows_fd[0], &saved_rows, sizeof(int));
-                    close(rows_fd[0]);
-                }
-                if (system == 1 && user == 1)
-                {
-                    moveCursorTo(base + samples + saved_rows + 8, 1);
-                }
-                else if (system == 1)
-                {
-                    moveCursorTo(base + samples + 6, 1);
-                }
-
-                else if (user == 1)
-                {
-                    moveCursorTo(base + saved_rows + 6, 1);
-                }
-                printf("Number of cores: %d", cores);
-                if (pipe(cpu_pipes[i]) == -1)
-                {
-                    perror("failed to create pipe");
-                    exit(EXIT_FAILURE);
-                }
-                pid_t cpu = fork();
-                if (cpu == -1)
-                {
-                    perror("fork failed");
-                    exit(EXIT_FAILURE);
-                }
-                else if (cpu == 0)
-                {
-                    long new_cpu_data[2];
-                    get_cpu_utilization(new_cpu_data);
-                    bytes_write = write(cpu_pipes[i][1], &new_cpu_data, 2 * sizeof(long));
-                    if (bytes_write == -1)
-                    {
-                        perror("Error writing to cpu pipe");
-                        exit(EXIT_FAILURE);
-                    }
-                    close(cpu_pipes[i][1]);
-                    exit(EXIT_SUCCESS);
-                }
-                else
-                {
-                    int cursor = 0;
-                    if (system == 1 && user == 1)
-                    {
-                        cursor = base + samples + saved_rows + 9;
-                    }
-                    else if (user == 1)
-                    {
-                        cursor = base + saved_rows + 7;
-                    }
-                    else if (system == 1)
-                    {
-                        cursor = base + samples + 7;
-                    }
-
-                    moveCursorTo(cursor, 1);
-                    print_cpu_utilization(cpu_pipes[i], cpu_data, i, graphics, cursor);
-                    if (i == samples - 1)
-                        printf("---------------------------------------\n");
-
-                    sleep(tdelay);
-                }
-                waitpid(cpu, NULL, 0);
-            }
-            waitpid(users, NULL, 0);
+            cursor = base + samples + saved_rows + 9;
         }
-        waitpid(memory, NULL, 0);
+        else if (user == 1)
+        {
+            cursor = base + saved_rows + 7;
+        }
+        else if (system == 1)
+        {
+            cursor = base + samples + 7;
+        }
+
+        moveCursorTo(cursor, 1);
+        print_cpu_utilization(&snapshot, cpu_data, &since, i, graphics, cursor);
+        if (i == samples - 1)
+            printf("---------------------------------------\n");
+
+        sleep(tdelay);
     }
     get_system_info();
 }
\ No newline at end of file
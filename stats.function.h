@@ -9,6 +9,7 @@
 #include <unistd.h>
 #include <errno.h>
 #include <sys/wait.h>
+#include <time.h>
 
 #ifndef STATS_FUNCTIONS_H
 #define STATS_FUNCTIONS_H
@@ -17,6 +18,25 @@
 #define MAX_USERS 100
 #define FLAGS_LENGTH 5
 #define GB_CONVERTER 1024 * 1024 * 1024
+#define NS_PER_SEC 1000000000L
+#define TIME_LENGTH 32
+
+/**
+ * One coherent sample of every collector. All collectors are released together by a start barrier.
+ * monotonic and realtime mark the start of the earliest collector read, and skew_ns spans from there
+ * to the end of the latest collector read.
+ */
+typedef struct
+{
+    struct timespec monotonic;
+    struct timespec realtime;
+    long skew_ns;
+    char memory[MAX_LENGTH];
+    double physical_used;
+    char users[MAX_USERS][MAX_LENGTH];
+    int rows;
+    long cpu_data[2];
+} system_snapshot;
 
 void moveCursorTo(int row, int col);
 void clearScreen();